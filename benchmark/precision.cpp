@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../cppfft/bfloat16.hpp"
+#include "../cppfft/compact_complex.hpp"
+#include "../cppfft/compensated.hpp"
+#include "../cppfft/fast_fourier_transform.hpp"
+
+namespace {
+
+using reference_type = std::complex<long double>;
+
+template <typename T>
+auto widen(T const& x) -> reference_type
+{
+    auto const z = std::complex<double>(x);
+    return reference_type(z.real(), z.imag());
+}
+
+auto reference(std::vector<reference_type> const& x) -> std::vector<reference_type>
+{
+    auto const n = std::ptrdiff_t(x.size());
+    auto const plan = cppfft::fast_fourier_transform<reference_type>(n);
+    auto y = std::vector<reference_type>(n);
+    plan.forward(x.cbegin(), y.begin());
+    return y;
+}
+
+auto error(std::vector<reference_type> const& x, std::vector<reference_type> const& y) -> double
+{
+    auto numerator = 0.L;
+    auto denominator = 0.L;
+
+    for (auto i = std::size_t{0}; i < x.size(); ++i)
+    {
+        numerator += std::norm(x[i] - y[i]);
+        denominator += std::norm(y[i]);
+    }
+
+    return double(std::sqrt(numerator / denominator));
+}
+
+template <typename Plan, typename DataType>
+auto measure(char const* data, char const* plan, std::ptrdiff_t n) -> void
+{
+    auto engine = std::mt19937(static_cast<std::mt19937::result_type>(n));
+    auto distribution = std::uniform_real_distribution<double>(-1., 1.);
+
+    auto x = std::vector<DataType>();
+    auto widened = std::vector<reference_type>();
+
+    for (auto i = std::ptrdiff_t{0}; i < n; ++i)
+    {
+        x.push_back(DataType(std::complex<double>(distribution(engine), distribution(engine))));
+        widened.push_back(widen(x.back()));
+    }
+
+    auto const transform = Plan(n);
+    auto y = std::vector<DataType>(n);
+    auto z = std::vector<DataType>(n);
+    transform.forward(x.cbegin(), y.begin());
+    transform.inverse(y.cbegin(), z.begin());
+
+    auto forward = std::vector<reference_type>();
+    auto round_trip = std::vector<reference_type>();
+    std::transform(y.cbegin(), y.cend(), std::back_inserter(forward), widen<DataType>);
+    std::transform(z.cbegin(), z.cend(), std::back_inserter(round_trip), widen<DataType>);
+
+    std::cout << std::left << std::setw(28) << data << std::setw(60) << plan
+        << std::setw(8) << n << std::scientific << std::setprecision(1)
+        << std::setw(12) << error(forward, reference(widened))
+        << error(round_trip, widened) << '\n' << std::defaultfloat;
+}
+
+} // namespace
+
+int main()
+{
+    using std::ptrdiff_t;
+    using cppfft::fast_fourier_transform;
+
+    std::cout << std::left << std::setw(28) << "data" << std::setw(60) << "plan"
+        << std::setw(8) << "n" << std::setw(12) << "forward" << "round trip\n";
+
+    for (auto const n : {ptrdiff_t{1} << 10, ptrdiff_t{1} << 14, ptrdiff_t{1} << 18,
+        ptrdiff_t{3 * 5 * 7 * 256}})
+    {
+        measure<fast_fourier_transform<std::complex<double>>, std::complex<float>>(
+            "complex<float>", "<complex<double>>", n);
+        measure<fast_fourier_transform<std::complex<double>, ptrdiff_t, std::complex<float>>,
+            std::complex<float>>(
+            "complex<float>", "<complex<double>, ptrdiff_t, complex<float>>", n);
+        measure<fast_fourier_transform<std::complex<float>>, std::complex<float>>(
+            "complex<float>", "<complex<float>>", n);
+        measure<fast_fourier_transform<std::complex<float>>, std::complex<double>>(
+            "complex<double>", "<complex<float>>", n);
+        measure<fast_fourier_transform<
+            cppfft::compensated_complex<float>, ptrdiff_t, std::complex<double>>,
+            std::complex<double>>(
+            "complex<double>", "<compensated_complex<float>, ptrdiff_t, complex<double>>", n);
+#ifdef __FLT16_MANT_DIG__
+        measure<fast_fourier_transform<std::complex<float>>, cppfft::compact_complex<_Float16>>(
+            "compact_complex<_Float16>", "<complex<float>>", n);
+        measure<fast_fourier_transform<
+            std::complex<float>, ptrdiff_t, cppfft::compact_complex<_Float16>>,
+            cppfft::compact_complex<_Float16>>(
+            "compact_complex<_Float16>", "<complex<float>, ptrdiff_t, compact_complex<_Float16>>", n);
+#endif
+        measure<fast_fourier_transform<std::complex<float>>,
+            cppfft::compact_complex<cppfft::bfloat16>>(
+            "compact_complex<bfloat16>", "<complex<float>>", n);
+        measure<fast_fourier_transform<
+            std::complex<float>, ptrdiff_t, cppfft::compact_complex<cppfft::bfloat16>>,
+            cppfft::compact_complex<cppfft::bfloat16>>(
+            "compact_complex<bfloat16>", "<complex<float>, ptrdiff_t, compact_complex<bfloat16>>", n);
+    }
+}
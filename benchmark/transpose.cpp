@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../cppfft/transpose.hpp"
+
+namespace {
+
+using value_type = std::complex<double>;
+
+template <typename Function>
+auto measure(char const* name, std::ptrdiff_t rows, std::ptrdiff_t columns, Function&& function)
+{
+    auto const repeat = 5;
+    auto best = std::chrono::duration<double>::max();
+
+    for (auto i = 0; i < repeat; ++i)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, std::chrono::duration<double>(elapsed));
+    }
+
+    auto const bytes = 2. * double(rows * columns) * double(sizeof(value_type));
+    std::cout << name << ' ' << rows << 'x' << columns << ": "
+        << best.count() * 1e3 << " ms, " << bytes / best.count() / 1e9 << " GB/s\n";
+}
+
+} // namespace
+
+int main()
+{
+    auto const concurrency = std::max(1u, std::thread::hardware_concurrency());
+
+    auto const shapes = {
+        std::make_pair(1024, 1024), std::make_pair(4096, 2048), std::make_pair(2048, 3000)};
+
+    for (auto const& shape : shapes)
+    {
+        auto const rows = std::ptrdiff_t{shape.first};
+        auto const columns = std::ptrdiff_t{shape.second};
+        auto input = std::vector<value_type>(rows * columns);
+        auto output = std::vector<value_type>(rows * columns);
+
+        for (auto i = std::ptrdiff_t{0}; i < rows * columns; ++i)
+        {
+            input[i] = value_type(double(i), -double(i));
+        }
+
+        measure("naive        ", rows, columns, [&]
+        {
+            for (auto i = std::ptrdiff_t{0}; i < rows; ++i)
+            {
+                for (auto j = std::ptrdiff_t{0}; j < columns; ++j)
+                {
+                    output[j * rows + i] = input[i * columns + j];
+                }
+            }
+        });
+
+        measure("blocked      ", rows, columns, [&]
+        {
+            cppfft::transpose(input.cbegin(), rows, columns, output.begin());
+        });
+
+        measure("threaded     ", rows, columns, [&]
+        {
+            cppfft::transpose(input.cbegin(), rows, columns, output.begin(), concurrency);
+        });
+
+        measure("in place     ", rows, columns, [&]
+        {
+            cppfft::transpose_in_place(output.begin(), rows, columns);
+        });
+    }
+}
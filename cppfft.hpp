@@ -1,7 +1,16 @@
 #ifndef CPPFFT_HPP
 #define CPPFFT_HPP
 
+#include "./cppfft/batch_executor.hpp"
+#include "./cppfft/bfloat16.hpp"
+#include "./cppfft/compact_complex.hpp"
+#include "./cppfft/compensated.hpp"
+#include "./cppfft/discrete_cosine_transform.hpp"
+#include "./cppfft/discrete_cosine_transform_iv.hpp"
+#include "./cppfft/discrete_sine_transform.hpp"
+#include "./cppfft/discrete_sine_transform_iv.hpp"
 #include "./cppfft/fast_fourier_transform.hpp"
+#include "./cppfft/file_storage.hpp"
 #include "./cppfft/fft.hpp"
 #include "./cppfft/fft_as.hpp"
 #include "./cppfft/fft_n.hpp"
@@ -10,5 +19,8 @@
 #include "./cppfft/ifft_as.hpp"
 #include "./cppfft/ifft_n.hpp"
 #include "./cppfft/ifft_n_as.hpp"
+#include "./cppfft/out_of_core_fourier_transform.hpp"
+#include "./cppfft/span_storage.hpp"
+#include "./cppfft/transpose.hpp"
 
 #endif // #ifndef CPPFFT_HPP
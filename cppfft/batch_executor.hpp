@@ -0,0 +1,399 @@
+#ifndef CPPFFT_BATCH_EXECUTOR_HPP
+#define CPPFFT_BATCH_EXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "./detail/bounded_queue.hpp"
+#include "./fast_fourier_transform.hpp"
+
+namespace cppfft {
+
+struct batch_executor_statistics
+{
+    std::uint64_t submitted;
+    std::uint64_t rejected;
+    std::uint64_t completed;
+    std::uint64_t failed;
+    std::chrono::nanoseconds total_wait;
+    std::chrono::nanoseconds max_wait;
+    std::chrono::nanoseconds total_latency;
+    std::chrono::nanoseconds max_latency;
+};
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class batch_executor
+{
+public:
+    using value_type = ComplexType;
+    using difference_type = DifferenceType;
+    using transform_type = cppfft::fast_fourier_transform<value_type, difference_type>;
+    using plan_type = std::shared_ptr<transform_type const>;
+    using frame_type = std::vector<value_type>;
+    using size_type = std::size_t;
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    struct task_base
+    {
+        virtual ~task_base() = default;
+        virtual auto operator()() -> bool = 0;
+    };
+
+    template <typename Function>
+    struct task_model : task_base
+    {
+        Function function;
+
+        explicit task_model(Function&& f)
+            : function(std::move(f))
+        {
+        }
+
+        auto operator()() -> bool override
+        {
+            return function();
+        }
+    };
+
+    struct job
+    {
+        std::unique_ptr<task_base> task;
+        clock_type::time_point submitted;
+    };
+
+    cppfft::detail::bounded_queue<job> queue;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::condition_variable space;
+    std::atomic<size_type> sleepers;
+    std::atomic<size_type> producers;
+    std::atomic<bool> stopping;
+
+    std::atomic<std::uint64_t> submitted;
+    std::atomic<std::uint64_t> rejected;
+    std::atomic<std::uint64_t> completed;
+    std::atomic<std::uint64_t> failed;
+    std::atomic<std::int64_t> total_wait;
+    std::atomic<std::int64_t> max_wait;
+    std::atomic<std::int64_t> total_latency;
+    std::atomic<std::int64_t> max_latency;
+
+public:
+    batch_executor() = delete;
+    batch_executor(batch_executor const&) = delete;
+    batch_executor(batch_executor&&) = delete;
+
+    batch_executor(size_type concurrency, size_type capacity)
+        : queue(capacity), sleepers(0u), producers(0u), stopping(false),
+          submitted(0u), rejected(0u), completed(0u), failed(0u),
+          total_wait(0), max_wait(0), total_latency(0), max_latency(0)
+    {
+        if (concurrency == 0u)
+        {
+            throw std::invalid_argument(
+                "batch_executor::batch_executor: concurrency must be positive\n");
+        }
+
+        workers.reserve(concurrency);
+
+        try
+        {
+            for (auto i = size_type{0u}; i < concurrency; ++i)
+            {
+                workers.emplace_back([this] { run(); });
+            }
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+
+    ~batch_executor()
+    {
+        stop();
+    }
+
+    auto operator=(batch_executor const&) -> batch_executor& = delete;
+    auto operator=(batch_executor&&) -> batch_executor& = delete;
+
+    auto concurrency() const noexcept -> size_type
+    {
+        return workers.size();
+    }
+
+    auto capacity() const noexcept -> size_type
+    {
+        return queue.capacity();
+    }
+
+    auto pending() const noexcept -> size_type
+    {
+        return queue.size();
+    }
+
+    auto statistics() const noexcept -> cppfft::batch_executor_statistics
+    {
+        return {
+            submitted.load(),
+            rejected.load(),
+            completed.load(),
+            failed.load(),
+            std::chrono::nanoseconds(total_wait.load()),
+            std::chrono::nanoseconds(max_wait.load()),
+            std::chrono::nanoseconds(total_latency.load()),
+            std::chrono::nanoseconds(max_latency.load())};
+    }
+
+    template <typename TransformType>
+    auto submit(TransformType&& type, plan_type plan, frame_type frame)
+        -> std::future<frame_type>
+    {
+        auto promise = std::make_shared<std::promise<frame_type>>();
+        auto result = promise->get_future();
+        push(make_job(std::forward<TransformType>(type), std::move(plan), std::move(frame),
+            [promise](frame_type&& f) { promise->set_value(std::move(f)); },
+            [promise](std::exception_ptr e) { promise->set_exception(e); }));
+        return result;
+    }
+
+    template <typename TransformType, typename Callback, typename ErrorCallback>
+    auto submit(
+        TransformType&& type,
+        plan_type plan,
+        frame_type frame,
+        Callback callback,
+        ErrorCallback error)
+        -> void
+    {
+        push(make_job(std::forward<TransformType>(type), std::move(plan), std::move(frame),
+            std::move(callback), std::move(error)));
+    }
+
+    template <typename TransformType>
+    auto try_submit(TransformType&& type, plan_type plan, frame_type frame)
+        -> std::future<frame_type>
+    {
+        auto promise = std::make_shared<std::promise<frame_type>>();
+        auto result = promise->get_future();
+        return try_push(make_job(std::forward<TransformType>(type), std::move(plan),
+            std::move(frame),
+            [promise](frame_type&& f) { promise->set_value(std::move(f)); },
+            [promise](std::exception_ptr e) { promise->set_exception(e); }))
+            ? std::move(result)
+            : std::future<frame_type>();
+    }
+
+    template <typename TransformType, typename Callback, typename ErrorCallback>
+    auto try_submit(
+        TransformType&& type,
+        plan_type plan,
+        frame_type frame,
+        Callback callback,
+        ErrorCallback error)
+        -> bool
+    {
+        return try_push(make_job(std::forward<TransformType>(type), std::move(plan),
+            std::move(frame), std::move(callback), std::move(error)));
+    }
+
+private:
+    template <typename TransformType, typename Callback, typename ErrorHandler>
+    static auto make_job(
+        TransformType&&,
+        plan_type plan,
+        frame_type frame,
+        Callback callback,
+        ErrorHandler handler)
+        -> std::enable_if_t<
+            std::is_same<std::decay_t<TransformType>, cppfft::forward_t>::value
+                || std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value,
+            job>
+    {
+        if (!plan)
+        {
+            throw std::invalid_argument("batch_executor::submit: plan must not be null\n");
+        }
+
+        if (static_cast<difference_type>(frame.size()) != plan->size())
+        {
+            throw std::length_error("batch_executor::submit: frame size must match the plan\n");
+        }
+
+        auto const is_inverse
+            = std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value;
+
+        auto task = [
+            is_inverse,
+            plan = std::move(plan),
+            frame = std::move(frame),
+            callback = std::move(callback),
+            handler = std::move(handler)]() mutable
+        {
+            try
+            {
+                is_inverse
+                    ? plan->inverse(frame.cbegin(), frame.begin())
+                    : plan->forward(frame.cbegin(), frame.begin());
+            }
+            catch (...)
+            {
+                handler(std::current_exception());
+                return false;
+            }
+
+            callback(std::move(frame));
+            return true;
+        };
+
+        return job{
+            std::make_unique<task_model<decltype(task)>>(std::move(task)),
+            clock_type::now()};
+    }
+
+    auto stop() -> void
+    {
+        {
+            std::lock_guard<std::mutex> const lock(mutex);
+            stopping.store(true);
+        }
+
+        condition.notify_all();
+        space.notify_all();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    static auto update_max(std::atomic<std::int64_t>& target, std::int64_t value) noexcept
+    {
+        auto current = target.load(std::memory_order_relaxed);
+        while (current < value
+            && !target.compare_exchange_weak(current, value, std::memory_order_relaxed));
+    }
+
+    auto wake() -> void
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (sleepers.load() != 0u)
+        {
+            {
+                std::lock_guard<std::mutex> const lock(mutex);
+            }
+
+            condition.notify_one();
+        }
+    }
+
+    auto push(job&& j) -> void
+    {
+        while (!queue.try_push(std::move(j)))
+        {
+            auto lock = std::unique_lock<std::mutex>(mutex);
+            producers.fetch_add(1u);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            space.wait(lock, [&] { return stopping.load() || queue.size() < queue.capacity(); });
+            producers.fetch_sub(1u);
+        }
+
+        submitted.fetch_add(1u, std::memory_order_relaxed);
+        wake();
+    }
+
+    auto try_push(job&& j) -> bool
+    {
+        if (!queue.try_push(std::move(j)))
+        {
+            rejected.fetch_add(1u, std::memory_order_relaxed);
+            return false;
+        }
+
+        submitted.fetch_add(1u, std::memory_order_relaxed);
+        wake();
+        return true;
+    }
+
+    auto run() -> void
+    {
+        auto current = job();
+
+        for (;;)
+        {
+            if (!queue.try_pop(current))
+            {
+                auto lock = std::unique_lock<std::mutex>(mutex);
+                sleepers.fetch_add(1u);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                condition.wait(lock, [&] { return stopping.load() || queue.size() != 0u; });
+                sleepers.fetch_sub(1u);
+
+                if (stopping.load() && queue.size() == 0u)
+                {
+                    return;
+                }
+
+                continue;
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (producers.load() != 0u)
+            {
+                {
+                    std::lock_guard<std::mutex> const lock(mutex);
+                }
+
+                space.notify_one();
+            }
+
+            auto const started = clock_type::now();
+            auto succeeded = false;
+
+            try
+            {
+                succeeded = (*current.task)();
+            }
+            catch (...)
+            {
+            }
+
+            (succeeded ? completed : failed).fetch_add(1u, std::memory_order_relaxed);
+
+            auto const finished = clock_type::now();
+            auto const wait = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                started - current.submitted).count();
+            auto const latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                finished - current.submitted).count();
+
+            current = job();
+
+            total_wait.fetch_add(wait, std::memory_order_relaxed);
+            total_latency.fetch_add(latency, std::memory_order_relaxed);
+            update_max(max_wait, wait);
+            update_max(max_latency, latency);
+        }
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_BATCH_EXECUTOR_HPP
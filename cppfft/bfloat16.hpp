@@ -0,0 +1,50 @@
+#ifndef CPPFFT_BFLOAT16_HPP
+#define CPPFFT_BFLOAT16_HPP
+
+#include <cstdint>
+#include <cstring>
+
+namespace cppfft {
+
+class bfloat16
+{
+private:
+    std::uint16_t bits;
+
+public:
+    bfloat16() = default;
+    bfloat16(bfloat16 const&) = default;
+    bfloat16(bfloat16&&) = default;
+
+    explicit bfloat16(float value) noexcept
+    {
+        auto word = std::uint32_t{};
+        std::memcpy(&word, &value, sizeof(word));
+
+        if ((word & 0x7fffffffu) > 0x7f800000u)
+        {
+            bits = static_cast<std::uint16_t>((word >> 16) | 0x0040u);
+            return;
+        }
+
+        word += 0x7fffu + ((word >> 16) & 1u);
+        bits = static_cast<std::uint16_t>(word >> 16);
+    }
+
+    ~bfloat16() = default;
+
+    auto operator=(bfloat16 const&) & -> bfloat16& = default;
+    auto operator=(bfloat16&&) & -> bfloat16& = default;
+
+    operator float() const noexcept
+    {
+        auto const word = std::uint32_t{bits} << 16;
+        auto value = float{};
+        std::memcpy(&value, &word, sizeof(value));
+        return value;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_BFLOAT16_HPP
@@ -0,0 +1,60 @@
+#ifndef CPPFFT_COMPACT_COMPLEX_HPP
+#define CPPFFT_COMPACT_COMPLEX_HPP
+
+#include <complex>
+#include <type_traits>
+
+namespace cppfft {
+
+template <typename T>
+class compact_complex
+{
+public:
+    using value_type = T;
+
+private:
+    value_type re;
+    value_type im;
+
+public:
+    compact_complex() = default;
+    compact_complex(compact_complex const&) = default;
+    compact_complex(compact_complex&&) = default;
+
+    compact_complex(value_type const& r, value_type const& i)
+        : re(r), im(i)
+    {
+    }
+
+    template <typename U>
+    compact_complex(std::complex<U> const& z)
+        : re(value_type(z.real())), im(value_type(z.imag()))
+    {
+    }
+
+    ~compact_complex() = default;
+
+    auto operator=(compact_complex const&) & -> compact_complex& = default;
+    auto operator=(compact_complex&&) & -> compact_complex& = default;
+
+    operator std::complex<std::common_type_t<value_type, float>>() const
+    {
+        using complex_type = std::complex<std::common_type_t<value_type, float>>;
+        using element_type = typename complex_type::value_type;
+        return complex_type(element_type(re), element_type(im));
+    }
+
+    auto real() const noexcept -> value_type const&
+    {
+        return re;
+    }
+
+    auto imag() const noexcept -> value_type const&
+    {
+        return im;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_COMPACT_COMPLEX_HPP
@@ -0,0 +1,242 @@
+#ifndef CPPFFT_COMPENSATED_HPP
+#define CPPFFT_COMPENSATED_HPP
+
+#include <cmath>
+#include <complex>
+#include <limits>
+
+namespace cppfft {
+
+template <typename T>
+class compensated
+{
+public:
+    using value_type = T;
+
+private:
+    value_type hi;
+    value_type lo;
+
+    compensated(value_type const& h, value_type const& l, bool)
+        : hi(h), lo(l)
+    {
+    }
+
+    static inline auto two_sum(value_type const& a, value_type const& b) -> compensated
+    {
+        auto const s = a + b;
+        auto const t = s - a;
+        return compensated(s, (a - (s - t)) + (b - t), true);
+    }
+
+    static inline auto quick_two_sum(value_type const& a, value_type const& b) -> compensated
+    {
+        auto const s = a + b;
+        return compensated(s, b - (s - a), true);
+    }
+
+    static inline auto two_prod(value_type const& a, value_type const& b) -> compensated
+    {
+        using std::fma;
+        auto const p = a * b;
+        return compensated(p, fma(a, b, -p), true);
+    }
+
+public:
+    compensated() = default;
+    compensated(compensated const&) = default;
+    compensated(compensated&&) = default;
+
+    compensated(double x)
+        : hi(), lo()
+    {
+        using std::ldexp;
+        auto const factor = ldexp(1., std::numeric_limits<double>::digits
+            - std::numeric_limits<value_type>::digits) + 1.;
+        auto const t = factor * x;
+        auto const h = t - (t - x);
+        hi = value_type(h);
+        lo = value_type(x - h);
+    }
+
+    ~compensated() = default;
+
+    auto operator=(compensated const&) & -> compensated& = default;
+    auto operator=(compensated&&) & -> compensated& = default;
+
+    explicit operator double() const
+    {
+        return double(hi) + double(lo);
+    }
+
+    auto operator-() const -> compensated
+    {
+        return compensated(-hi, -lo, true);
+    }
+
+    friend auto operator+(compensated const& x, compensated const& y) -> compensated
+    {
+        auto s = two_sum(x.hi, y.hi);
+        auto const t = two_sum(x.lo, y.lo);
+        s = quick_two_sum(s.hi, s.lo + t.hi);
+        return quick_two_sum(s.hi, s.lo + t.lo);
+    }
+
+    friend auto operator-(compensated const& x, compensated const& y) -> compensated
+    {
+        return x + -y;
+    }
+
+    friend auto operator*(compensated const& x, compensated const& y) -> compensated
+    {
+        auto const p = two_prod(x.hi, y.hi);
+        return quick_two_sum(p.hi, p.lo + (x.hi * y.lo + x.lo * y.hi));
+    }
+
+    friend auto operator/(compensated const& x, compensated const& y) -> compensated
+    {
+        auto const q = x.hi / y.hi;
+        auto const r = x - y * compensated(q, value_type(0), true);
+        return quick_two_sum(q, r.hi / y.hi);
+    }
+
+    auto operator+=(compensated const& x) & -> compensated&
+    {
+        return *this = *this + x;
+    }
+
+    auto operator-=(compensated const& x) & -> compensated&
+    {
+        return *this = *this - x;
+    }
+
+    auto operator*=(compensated const& x) & -> compensated&
+    {
+        return *this = *this * x;
+    }
+
+    auto operator/=(compensated const& x) & -> compensated&
+    {
+        return *this = *this / x;
+    }
+};
+
+template <typename T>
+class compensated_complex
+{
+public:
+    using value_type = cppfft::compensated<T>;
+
+private:
+    value_type re;
+    value_type im;
+
+public:
+    compensated_complex() = default;
+    compensated_complex(compensated_complex const&) = default;
+    compensated_complex(compensated_complex&&) = default;
+
+    compensated_complex(value_type const& r, value_type const& i = value_type(0.))
+        : re(r), im(i)
+    {
+    }
+
+    template <typename U>
+    compensated_complex(std::complex<U> const& z)
+        : re(double(z.real())), im(double(z.imag()))
+    {
+    }
+
+    ~compensated_complex() = default;
+
+    auto operator=(compensated_complex const&) & -> compensated_complex& = default;
+    auto operator=(compensated_complex&&) & -> compensated_complex& = default;
+
+    operator std::complex<double>() const
+    {
+        return std::complex<double>(double(re), double(im));
+    }
+
+    auto real() const noexcept -> value_type const&
+    {
+        return re;
+    }
+
+    auto imag() const noexcept -> value_type const&
+    {
+        return im;
+    }
+
+    friend auto operator+(compensated_complex const& x, compensated_complex const& y)
+        -> compensated_complex
+    {
+        return compensated_complex(x.re + y.re, x.im + y.im);
+    }
+
+    friend auto operator-(compensated_complex const& x, compensated_complex const& y)
+        -> compensated_complex
+    {
+        return compensated_complex(x.re - y.re, x.im - y.im);
+    }
+
+    friend auto operator*(compensated_complex const& x, compensated_complex const& y)
+        -> compensated_complex
+    {
+        return compensated_complex(x.re * y.re - x.im * y.im, x.re * y.im + x.im * y.re);
+    }
+
+    friend auto operator*(value_type const& x, compensated_complex const& y)
+        -> compensated_complex
+    {
+        return compensated_complex(x * y.re, x * y.im);
+    }
+
+    friend auto operator*(compensated_complex const& x, value_type const& y)
+        -> compensated_complex
+    {
+        return compensated_complex(x.re * y, x.im * y);
+    }
+
+    friend auto operator/(compensated_complex const& x, value_type const& y)
+        -> compensated_complex
+    {
+        return compensated_complex(x.re / y, x.im / y);
+    }
+
+    auto operator+=(compensated_complex const& x) & -> compensated_complex&
+    {
+        return *this = *this + x;
+    }
+
+    auto operator-=(compensated_complex const& x) & -> compensated_complex&
+    {
+        return *this = *this - x;
+    }
+
+    auto operator*=(compensated_complex const& x) & -> compensated_complex&
+    {
+        return *this = *this * x;
+    }
+};
+
+template <typename T>
+inline auto real(cppfft::compensated_complex<T> const& z) -> cppfft::compensated<T>
+{
+    return z.real();
+}
+
+template <typename T>
+inline auto imag(cppfft::compensated_complex<T> const& z) -> cppfft::compensated<T>
+{
+    return z.imag();
+}
+
+template <typename T>
+inline auto conj(cppfft::compensated_complex<T> const& z) -> cppfft::compensated_complex<T>
+{
+    return cppfft::compensated_complex<T>(z.real(), -z.imag());
+}
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_COMPENSATED_HPP
@@ -0,0 +1,139 @@
+#ifndef CPPFFT_DETAIL_BOUNDED_QUEUE_HPP
+#define CPPFFT_DETAIL_BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace cppfft { namespace detail {
+
+template <typename T>
+class bounded_queue
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+private:
+    struct cell
+    {
+        std::atomic<size_type> sequence;
+        value_type data;
+    };
+
+    static constexpr auto cache_line_size = std::size_t{64u};
+
+    std::unique_ptr<cell[]> buffer;
+    size_type mask;
+    alignas(cache_line_size) std::atomic<size_type> enqueue_position;
+    alignas(cache_line_size) std::atomic<size_type> dequeue_position;
+
+public:
+    bounded_queue() = delete;
+    bounded_queue(bounded_queue const&) = delete;
+    bounded_queue(bounded_queue&&) = delete;
+
+    explicit bounded_queue(size_type capacity)
+        : enqueue_position(0u), dequeue_position(0u)
+    {
+        auto size = size_type{2u};
+
+        while (size < capacity)
+        {
+            size *= 2u;
+        }
+
+        buffer.reset(new cell[size]);
+        mask = size - 1u;
+
+        for (auto i = size_type{0u}; i < size; ++i)
+        {
+            buffer[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~bounded_queue() = default;
+
+    auto operator=(bounded_queue const&) -> bounded_queue& = delete;
+    auto operator=(bounded_queue&&) -> bounded_queue& = delete;
+
+    auto capacity() const noexcept -> size_type
+    {
+        return mask + 1u;
+    }
+
+    auto size() const noexcept -> size_type
+    {
+        auto const tail = dequeue_position.load(std::memory_order_acquire);
+        auto const head = enqueue_position.load(std::memory_order_acquire);
+        return head > tail ? head - tail : size_type{0u};
+    }
+
+    auto try_push(value_type&& value) -> bool
+    {
+        auto position = enqueue_position.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& target = buffer[position & mask];
+            auto const sequence = target.sequence.load(std::memory_order_acquire);
+            auto const difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+            if (difference == 0)
+            {
+                if (enqueue_position.compare_exchange_weak(
+                    position, position + 1u, std::memory_order_relaxed))
+                {
+                    target.data = std::move(value);
+                    target.sequence.store(position + 1u, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    auto try_pop(value_type& value) -> bool
+    {
+        auto position = dequeue_position.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& target = buffer[position & mask];
+            auto const sequence = target.sequence.load(std::memory_order_acquire);
+            auto const difference = static_cast<std::ptrdiff_t>(sequence - (position + 1u));
+
+            if (difference == 0)
+            {
+                if (dequeue_position.compare_exchange_weak(
+                    position, position + 1u, std::memory_order_relaxed))
+                {
+                    value = std::move(target.data);
+                    target.data = value_type();
+                    target.sequence.store(position + mask + 1u, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+} } // namespace cppfft::detail
+
+#endif // #ifndef CPPFFT_DETAIL_BOUNDED_QUEUE_HPP
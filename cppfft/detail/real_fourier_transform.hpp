@@ -0,0 +1,156 @@
+#ifndef CPPFFT_DETAIL_REAL_FOURIER_TRANSFORM_HPP
+#define CPPFFT_DETAIL_REAL_FOURIER_TRANSFORM_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include "../fast_fourier_transform.hpp"
+#include "./unit_phasor.hpp"
+
+namespace cppfft { namespace detail {
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class real_fourier_transform
+{
+public:
+    using value_type = ComplexType;
+    using element_type = typename value_type::value_type;
+    using difference_type = DifferenceType;
+
+private:
+    cppfft::fast_fourier_transform<value_type, difference_type> transform;
+    std::vector<value_type> twiddles;
+    difference_type sequence_size;
+
+public:
+    real_fourier_transform() = delete;
+    real_fourier_transform(real_fourier_transform const&) = default;
+    real_fourier_transform(real_fourier_transform&&) = default;
+
+    explicit real_fourier_transform(difference_type n)
+        : transform(n % 2 == 0 ? n / 2 : n), sequence_size(n)
+    {
+        if (n % 2 != 0)
+        {
+            return;
+        }
+
+        twiddles.resize(n / 2 + 1);
+
+        for (auto i = difference_type{0}; i <= n / 2; ++i)
+        {
+            twiddles.at(i) = cppfft::detail::unit_phasor<value_type>(-2 * i, n);
+        }
+    }
+
+    ~real_fourier_transform() = default;
+
+    auto operator=(real_fourier_transform const&) & -> real_fourier_transform& = default;
+    auto operator=(real_fourier_transform&&) & -> real_fourier_transform& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return sequence_size;
+    }
+
+    template <typename RandomAccessIterator, typename OutputIterator>
+    auto forward(RandomAccessIterator first, OutputIterator result) const -> OutputIterator
+    {
+        using std::conj;
+
+        if (sequence_size == difference_type{0})
+        {
+            return result;
+        }
+
+        if (sequence_size % 2 != 0)
+        {
+            auto buffer = std::vector<value_type>(sequence_size);
+
+            for (auto i = difference_type{0}; i < sequence_size; ++i)
+            {
+                buffer[i] = value_type(first[i]);
+            }
+
+            transform.forward(buffer.cbegin(), buffer.begin());
+            return std::move(buffer.begin(), buffer.begin() + sequence_size / 2 + 1, result);
+        }
+
+        auto const half = sequence_size / 2;
+        auto buffer = std::vector<value_type>(half);
+
+        for (auto i = difference_type{0}; i < half; ++i)
+        {
+            buffer[i] = value_type(first[2 * i], first[2 * i + 1]);
+        }
+
+        transform.forward(buffer.cbegin(), buffer.begin());
+
+        for (auto i = difference_type{0}; i <= half; ++i, ++result)
+        {
+            auto const t0 = buffer[i % half];
+            auto const t1 = conj(buffer[(half - i) % half]);
+            auto const even = (t0 + t1) * element_type(0.5);
+            auto const odd = (t0 - t1) * value_type(element_type(0.), element_type(-0.5));
+            *result = even + twiddles[i] * odd;
+        }
+
+        return result;
+    }
+
+    template <typename RandomAccessIterator, typename OutputIterator>
+    auto inverse(RandomAccessIterator first, OutputIterator result) const -> OutputIterator
+    {
+        using std::conj;
+        using std::real;
+        using std::imag;
+
+        if (sequence_size == difference_type{0})
+        {
+            return result;
+        }
+
+        if (sequence_size % 2 != 0)
+        {
+            auto buffer = std::vector<value_type>(sequence_size);
+            buffer[0] = first[0];
+
+            for (auto i = difference_type{1}; i <= sequence_size / 2; ++i)
+            {
+                buffer[i] = first[i];
+                buffer[sequence_size - i] = conj(value_type(first[i]));
+            }
+
+            transform.inverse(buffer.cbegin(), buffer.begin());
+            return std::transform(buffer.cbegin(), buffer.cend(), result,
+                [](auto const& v) { return real(v); });
+        }
+
+        auto const half = sequence_size / 2;
+        auto buffer = std::vector<value_type>(half);
+
+        for (auto i = difference_type{0}; i < half; ++i)
+        {
+            auto const t0 = value_type(first[i]);
+            auto const t1 = conj(value_type(first[half - i]));
+            auto const even = (t0 + t1) * element_type(0.5);
+            auto const odd = (t0 - t1) * conj(twiddles[i]) * element_type(0.5);
+            buffer[i] = even + value_type(-imag(odd), real(odd));
+        }
+
+        transform.inverse(buffer.cbegin(), buffer.begin());
+
+        for (auto i = difference_type{0}; i < half; ++i)
+        {
+            *result++ = real(buffer[i]);
+            *result++ = imag(buffer[i]);
+        }
+
+        return result;
+    }
+};
+
+} } // namespace cppfft::detail
+
+#endif // #ifndef CPPFFT_DETAIL_REAL_FOURIER_TRANSFORM_HPP
@@ -0,0 +1,29 @@
+#ifndef CPPFFT_DETAIL_UNIT_PHASOR_HPP
+#define CPPFFT_DETAIL_UNIT_PHASOR_HPP
+
+#include <cmath>
+#include <type_traits>
+
+namespace cppfft { namespace detail {
+
+template <typename ComplexType, typename Integer>
+inline auto unit_phasor(Integer numerator, Integer denominator) -> ComplexType
+{
+    using element_type = typename ComplexType::value_type;
+    using precise_type = std::conditional_t<
+        std::is_floating_point<element_type>::value,
+        std::common_type_t<element_type, double>,
+        double>;
+
+    using std::acos;
+    using std::cos;
+    using std::sin;
+
+    auto const angle
+        = acos(precise_type(-1.)) * precise_type(numerator) / precise_type(denominator);
+    return ComplexType(element_type(cos(angle)), element_type(sin(angle)));
+}
+
+} } // namespace cppfft::detail
+
+#endif // #ifndef CPPFFT_DETAIL_UNIT_PHASOR_HPP
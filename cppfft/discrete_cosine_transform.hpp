@@ -0,0 +1,176 @@
+#ifndef CPPFFT_DISCRETE_COSINE_TRANSFORM_HPP
+#define CPPFFT_DISCRETE_COSINE_TRANSFORM_HPP
+
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "./detail/is_inputtable_iterator.hpp"
+#include "./detail/is_outputtable_iterator.hpp"
+#include "./detail/real_fourier_transform.hpp"
+#include "./detail/unit_phasor.hpp"
+#include "./fast_fourier_transform.hpp"
+
+namespace cppfft {
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class discrete_cosine_transform
+{
+public:
+    using value_type = ComplexType;
+    using element_type = typename value_type::value_type;
+    using difference_type = DifferenceType;
+
+private:
+    cppfft::detail::real_fourier_transform<value_type, difference_type> transform;
+    std::vector<value_type> twiddles;
+    difference_type sequence_size;
+
+public:
+    discrete_cosine_transform() = delete;
+    discrete_cosine_transform(discrete_cosine_transform const&) = default;
+    discrete_cosine_transform(discrete_cosine_transform&&) = default;
+
+    explicit discrete_cosine_transform(difference_type n)
+        : transform(validate(n)), sequence_size(n)
+    {
+        twiddles.resize(sequence_size);
+
+        for (auto i = difference_type{0}; i < sequence_size; ++i)
+        {
+            twiddles.at(i) = cppfft::detail::unit_phasor<value_type>(-i, 2 * n);
+        }
+    }
+
+    ~discrete_cosine_transform() = default;
+
+    auto operator=(discrete_cosine_transform const&) & -> discrete_cosine_transform& = default;
+    auto operator=(discrete_cosine_transform&&) & -> discrete_cosine_transform& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return sequence_size;
+    }
+
+    template <typename TransformType, typename InputIterator, typename OutputIterator>
+    auto operator()(TransformType&&, InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            (std::is_same<std::decay_t<TransformType>, cppfft::forward_t>::value
+                || std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value)
+                && cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value
+            ? type3(first, result)
+            : type2(first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto operator()(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto forward(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto inverse(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::inverse, first, result);
+    }
+
+private:
+    static auto validate(difference_type n) -> difference_type
+    {
+        if (n < 0)
+        {
+            throw std::length_error(
+                "discrete_cosine_transform::discrete_cosine_transform: size must be non-negative\n");
+        }
+
+        return n;
+    }
+
+    auto position(difference_type const& i) const noexcept -> difference_type
+    {
+        return i % 2 == 0 ? i / 2 : sequence_size - 1 - i / 2;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto type2(InputIterator first, OutputIterator result) const -> OutputIterator
+    {
+        using std::conj;
+        using std::real;
+
+        auto buffer = std::vector<element_type>(sequence_size);
+
+        for (auto i = difference_type{0}; i < sequence_size; void(++i), void(++first))
+        {
+            buffer[position(i)] = *first;
+        }
+
+        auto spectrum = std::vector<value_type>(sequence_size / 2 + 1);
+        transform.forward(buffer.cbegin(), spectrum.begin());
+
+        for (auto i = difference_type{0}; i < sequence_size; void(++i), void(++result))
+        {
+            *result = real(twiddles[i]
+                * (i <= sequence_size / 2 ? spectrum[i] : conj(spectrum[sequence_size - i])));
+        }
+
+        return result;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto type3(InputIterator first, OutputIterator result) const -> OutputIterator
+    {
+        using std::conj;
+
+        auto buffer = std::vector<element_type>(sequence_size);
+
+        for (auto i = difference_type{0}; i < sequence_size; void(++i), void(++first))
+        {
+            buffer[i] = *first;
+        }
+
+        auto spectrum = std::vector<value_type>(sequence_size / 2 + 1);
+
+        for (auto i = difference_type{0}; i < sequence_size && i <= sequence_size / 2; ++i)
+        {
+            spectrum[i] = conj(twiddles[i]) * value_type(
+                buffer[i], i == 0 ? element_type(0.) : -buffer[sequence_size - i]);
+        }
+
+        transform.inverse(spectrum.cbegin(), buffer.begin());
+
+        for (auto i = difference_type{0}; i < sequence_size; void(++i), void(++result))
+        {
+            *result = buffer[position(i)];
+        }
+
+        return result;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_DISCRETE_COSINE_TRANSFORM_HPP
@@ -0,0 +1,155 @@
+#ifndef CPPFFT_DISCRETE_COSINE_TRANSFORM_IV_HPP
+#define CPPFFT_DISCRETE_COSINE_TRANSFORM_IV_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "./detail/is_inputtable_iterator.hpp"
+#include "./detail/is_outputtable_iterator.hpp"
+#include "./detail/unit_phasor.hpp"
+#include "./fast_fourier_transform.hpp"
+
+namespace cppfft {
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class discrete_cosine_transform_iv
+{
+public:
+    using value_type = ComplexType;
+    using element_type = typename value_type::value_type;
+    using difference_type = DifferenceType;
+
+private:
+    cppfft::fast_fourier_transform<value_type, difference_type> transform;
+    std::vector<value_type> twiddles;
+    difference_type sequence_size;
+
+public:
+    discrete_cosine_transform_iv() = delete;
+    discrete_cosine_transform_iv(discrete_cosine_transform_iv const&) = default;
+    discrete_cosine_transform_iv(discrete_cosine_transform_iv&&) = default;
+
+    explicit discrete_cosine_transform_iv(difference_type n)
+        : transform(validate(n) / 2), sequence_size(n)
+    {
+        twiddles.resize(sequence_size);
+
+        for (auto i = difference_type{0}; i < sequence_size / 2; ++i)
+        {
+            twiddles.at(i) = cppfft::detail::unit_phasor<value_type>(-(4 * i + 1), 4 * n);
+            twiddles.at(sequence_size / 2 + i) = cppfft::detail::unit_phasor<value_type>(-i, n);
+        }
+    }
+
+    ~discrete_cosine_transform_iv() = default;
+
+    auto operator=(discrete_cosine_transform_iv const&) & -> discrete_cosine_transform_iv& = default;
+    auto operator=(discrete_cosine_transform_iv&&) & -> discrete_cosine_transform_iv& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return sequence_size;
+    }
+
+    template <typename TransformType, typename InputIterator, typename OutputIterator>
+    auto operator()(TransformType&&, InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            (std::is_same<std::decay_t<TransformType>, cppfft::forward_t>::value
+                || std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value)
+                && cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        using std::real;
+        using std::imag;
+
+        auto const is_inverse
+            = std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value;
+        auto const half = sequence_size / 2;
+
+        auto buffer = std::vector<element_type>(sequence_size);
+
+        for (auto i = difference_type{0}; i < sequence_size; void(++i), void(++first))
+        {
+            buffer[i] = *first;
+        }
+
+        auto spectrum = std::vector<value_type>(half);
+
+        for (auto i = difference_type{0}; i < half; ++i)
+        {
+            spectrum[i]
+                = twiddles[i] * value_type(buffer[2 * i], buffer[sequence_size - 1 - 2 * i]);
+        }
+
+        transform.forward(spectrum.cbegin(), spectrum.begin());
+
+        auto const scale = is_inverse
+            ? element_type(2.) / element_type(sequence_size)
+            : element_type(1.);
+
+        for (auto i = difference_type{0}; i < half; ++i)
+        {
+            auto const t = twiddles[half + i] * spectrum[i];
+            buffer[2 * i] = scale * real(t);
+            buffer[sequence_size - 1 - 2 * i] = -scale * imag(t);
+        }
+
+        return std::move(buffer.begin(), buffer.end(), result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto operator()(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto forward(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto inverse(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::inverse, first, result);
+    }
+
+private:
+    static auto validate(difference_type n) -> difference_type
+    {
+        if (n < 0)
+        {
+            throw std::length_error(
+                "discrete_cosine_transform_iv::discrete_cosine_transform_iv: size must be non-negative\n");
+        }
+
+        if (n % 2 != 0)
+        {
+            throw std::invalid_argument(
+                "discrete_cosine_transform_iv::discrete_cosine_transform_iv: size must be even\n");
+        }
+
+        return n;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_DISCRETE_COSINE_TRANSFORM_IV_HPP
@@ -0,0 +1,139 @@
+#ifndef CPPFFT_DISCRETE_SINE_TRANSFORM_HPP
+#define CPPFFT_DISCRETE_SINE_TRANSFORM_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "./detail/is_inputtable_iterator.hpp"
+#include "./detail/is_outputtable_iterator.hpp"
+#include "./discrete_cosine_transform.hpp"
+#include "./fast_fourier_transform.hpp"
+
+namespace cppfft {
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class discrete_sine_transform
+{
+public:
+    using value_type = ComplexType;
+    using element_type = typename value_type::value_type;
+    using difference_type = DifferenceType;
+
+private:
+    cppfft::discrete_cosine_transform<value_type, difference_type> transform;
+
+public:
+    discrete_sine_transform() = delete;
+    discrete_sine_transform(discrete_sine_transform const&) = default;
+    discrete_sine_transform(discrete_sine_transform&&) = default;
+
+    explicit discrete_sine_transform(difference_type n)
+        : transform(validate(n))
+    {
+    }
+
+    ~discrete_sine_transform() = default;
+
+    auto operator=(discrete_sine_transform const&) & -> discrete_sine_transform& = default;
+    auto operator=(discrete_sine_transform&&) & -> discrete_sine_transform& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return transform.size();
+    }
+
+    template <typename TransformType, typename InputIterator, typename OutputIterator>
+    auto operator()(TransformType&&, InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            (std::is_same<std::decay_t<TransformType>, cppfft::forward_t>::value
+                || std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value)
+                && cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value
+            ? type3(first, result)
+            : type2(first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto operator()(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto forward(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto inverse(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::inverse, first, result);
+    }
+
+private:
+    static auto validate(difference_type n) -> difference_type
+    {
+        if (n < 0)
+        {
+            throw std::length_error(
+                "discrete_sine_transform::discrete_sine_transform: size must be non-negative\n");
+        }
+
+        return n;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto type2(InputIterator first, OutputIterator result) const -> OutputIterator
+    {
+        auto buffer = std::vector<element_type>(size());
+
+        for (auto i = difference_type{0}; i < size(); void(++i), void(++first))
+        {
+            buffer[i] = i % 2 == 0 ? element_type(*first) : -element_type(*first);
+        }
+
+        transform.forward(buffer.cbegin(), buffer.begin());
+        return std::move(buffer.rbegin(), buffer.rend(), result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto type3(InputIterator first, OutputIterator result) const -> OutputIterator
+    {
+        auto buffer = std::vector<element_type>(size());
+
+        for (auto i = difference_type{0}; i < size(); void(++i), void(++first))
+        {
+            buffer[size() - 1 - i] = *first;
+        }
+
+        transform.inverse(buffer.cbegin(), buffer.begin());
+
+        for (auto i = difference_type{0}; i < size(); void(++i), void(++result))
+        {
+            *result = i % 2 == 0 ? buffer[i] : -buffer[i];
+        }
+
+        return result;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_DISCRETE_SINE_TRANSFORM_HPP
@@ -0,0 +1,123 @@
+#ifndef CPPFFT_DISCRETE_SINE_TRANSFORM_IV_HPP
+#define CPPFFT_DISCRETE_SINE_TRANSFORM_IV_HPP
+
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "./detail/is_inputtable_iterator.hpp"
+#include "./detail/is_outputtable_iterator.hpp"
+#include "./discrete_cosine_transform_iv.hpp"
+#include "./fast_fourier_transform.hpp"
+
+namespace cppfft {
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class discrete_sine_transform_iv
+{
+public:
+    using value_type = ComplexType;
+    using element_type = typename value_type::value_type;
+    using difference_type = DifferenceType;
+
+private:
+    cppfft::discrete_cosine_transform_iv<value_type, difference_type> transform;
+
+public:
+    discrete_sine_transform_iv() = delete;
+    discrete_sine_transform_iv(discrete_sine_transform_iv const&) = default;
+    discrete_sine_transform_iv(discrete_sine_transform_iv&&) = default;
+
+    explicit discrete_sine_transform_iv(difference_type n)
+        : transform(validate(n))
+    {
+    }
+
+    ~discrete_sine_transform_iv() = default;
+
+    auto operator=(discrete_sine_transform_iv const&) & -> discrete_sine_transform_iv& = default;
+    auto operator=(discrete_sine_transform_iv&&) & -> discrete_sine_transform_iv& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return transform.size();
+    }
+
+    template <typename TransformType, typename InputIterator, typename OutputIterator>
+    auto operator()(TransformType&& type, InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            (std::is_same<std::decay_t<TransformType>, cppfft::forward_t>::value
+                || std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value)
+                && cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        auto buffer = std::vector<element_type>(size());
+
+        for (auto i = difference_type{0}; i < size(); void(++i), void(++first))
+        {
+            buffer[size() - 1 - i] = *first;
+        }
+
+        transform(std::forward<TransformType>(type), buffer.cbegin(), buffer.begin());
+
+        for (auto i = difference_type{0}; i < size(); void(++i), void(++result))
+        {
+            *result = i % 2 == 0 ? buffer[i] : -buffer[i];
+        }
+
+        return result;
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto operator()(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto forward(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::forward, first, result);
+    }
+
+    template <typename InputIterator, typename OutputIterator>
+    auto inverse(InputIterator first, OutputIterator result) const
+        -> std::enable_if_t<
+            cppfft::detail::is_inputtable_iterator_v<InputIterator>
+                && cppfft::detail::is_outputtable_iterator_v<OutputIterator>,
+            OutputIterator>
+    {
+        return (*this)(cppfft::inverse, first, result);
+    }
+
+private:
+    static auto validate(difference_type n) -> difference_type
+    {
+        if (n < 0)
+        {
+            throw std::length_error(
+                "discrete_sine_transform_iv::discrete_sine_transform_iv: size must be non-negative\n");
+        }
+
+        if (n % 2 != 0)
+        {
+            throw std::invalid_argument(
+                "discrete_sine_transform_iv::discrete_sine_transform_iv: size must be even\n");
+        }
+
+        return n;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_DISCRETE_SINE_TRANSFORM_IV_HPP
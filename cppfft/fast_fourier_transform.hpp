@@ -13,6 +13,8 @@
 #include "./detail/is_inputtable_iterator.hpp"
 #include "./detail/is_outputtable_iterator.hpp"
 #include "./detail/is_random_accessible_iterator.hpp"
+#include "./detail/unit_phasor.hpp"
+#include "./transpose.hpp"
 
 namespace cppfft {
 
@@ -48,8 +50,12 @@ auto replace(
     auto const& length = radices.back();
     auto const stride = size / length;
 
-    auto coefficient = std::vector<difference_type>(radices.size() - 1u);
-    coefficient.back() = difference_type{1};
+    if (radices.size() <= 2u)
+    {
+        return cppfft::transpose(first, length, stride, result);
+    }
+
+    auto coefficient = std::vector<difference_type>(radices.size() - 1u, difference_type{1});
 
     for (auto i = std::size_t{1}; i < coefficient.size(); ++i)
     {
@@ -90,8 +96,7 @@ auto replace(
     auto const length = radices.back();
     auto const stride = size / length;
 
-    auto coefficient = std::vector<difference_type>(radices.size() - 1u);
-    coefficient.back() = difference_type{1};
+    auto coefficient = std::vector<difference_type>(radices.size() - 1u, difference_type{1});
 
     for (auto i = std::size_t{1}; i < coefficient.size(); ++i)
     {
@@ -122,16 +127,20 @@ auto replace(
 constexpr struct forward_t {} forward{};
 constexpr struct inverse_t {} inverse{};
 
-template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+template <
+    typename ComplexType,
+    typename DifferenceType = std::ptrdiff_t,
+    typename StorageType = ComplexType>
 class fast_fourier_transform
 {
 public:
     using value_type = ComplexType;
     using element_type = typename value_type::value_type;
     using difference_type = DifferenceType;
+    using storage_type = StorageType;
 
 private:
-    std::vector<value_type> twiddles;
+    std::vector<storage_type> twiddles;
     std::vector<difference_type> radices;
     difference_type sequence_size;
 
@@ -151,13 +160,10 @@ public:
 
         twiddles.resize(sequence_size);
 
-        using std::acos;
-        auto const k = element_type(-2. * acos(element_type(-1.)) / element_type(n));
-
-        for (auto i = std::size_t{0u}; i < sequence_size; ++i)
+        for (auto i = difference_type{0}; i < sequence_size; ++i)
         {
-            using std::exp;
-            twiddles.at(i) = exp(value_type(element_type(0.), element_type(i) * k));
+            twiddles.at(i)
+                = store(cppfft::detail::unit_phasor<value_type>(-2 * i, sequence_size));
         }
 
         for (auto i = difference_type{4}; i * i <= n; )
@@ -197,10 +203,21 @@ public:
         auto const is_inverse
             = std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value;
 
-        auto buffer = std::vector<value_type>(sequence_size);
+        if (sequence_size == difference_type{0})
+        {
+            return result;
+        }
+
+        auto buffer = std::vector<storage_type>(sequence_size);
 
         cppfft::detail::replace(radices, first, sequence_size, buffer.begin());
 
+        if (is_inverse)
+        {
+            std::transform(buffer.begin(), buffer.end(), buffer.begin(),
+                [&](auto const& v) { return store(load(v) / element_type(sequence_size)); });
+        }
+
         auto stride = sequence_size;
 
         for (auto radix = radices.rbegin(); radix != radices.rend(); ++radix)
@@ -214,10 +231,7 @@ public:
             }
         }
 
-        return is_inverse
-            ? std::transform(buffer.begin(), buffer.end(), result,
-                [&](auto const& v) { return v / element_type(sequence_size); })
-            : std::move(buffer.begin(), buffer.end(), result);
+        return std::move(buffer.begin(), buffer.end(), result);
     }
 
     template <typename InputIterator, typename OutputIterator>
@@ -251,11 +265,23 @@ public:
     }
 
 private:
-    template <typename T>
-    static inline constexpr auto conjugate(bool const flag, T&& x) -> decltype(auto)
+    using iterator = typename std::vector<storage_type>::iterator;
+
+    static inline auto load(storage_type const& x) -> value_type
+    {
+        return value_type(x);
+    }
+
+    static inline auto store(value_type const& x) -> storage_type
+    {
+        return storage_type(x);
+    }
+
+    inline auto twiddle(bool const is_inverse, difference_type const& index) const -> value_type
     {
         using std::conj;
-        return flag ? conj(std::forward<T>(x)) : std::forward<T>(x);
+        auto const t = load(twiddles[index]);
+        return is_inverse ? conj(t) : t;
     }
 
     auto butterfly(
@@ -263,7 +289,7 @@ private:
         bool const is_inverse,
         difference_type const& remainder,
         difference_type const& stride,
-        typename std::vector<value_type>::iterator first) const
+        iterator first) const
     {
         switch (radix)
         {
@@ -280,18 +306,20 @@ private:
         {
             for (auto j = difference_type{0}; j < radix; ++j)
             {
-                tmp.at(j) = first[i + j * remainder];
+                tmp.at(j) = load(first[i + j * remainder]);
             }
 
-            for (auto j = i; j < radix; j += remainder)
+            for (auto j = difference_type{0}; j < radix; ++j)
             {
-                first[j] = value_type(0.);
+                auto const index = i + j * remainder;
+                auto sum = value_type(0.);
 
                 for (auto k = difference_type{0}; k < radix; ++k)
                 {
-                    first[j] += tmp.at(k)
-                        * conjugate(is_inverse, twiddles.at((k * j * stride) % sequence_size));
+                    sum += tmp.at(k) * twiddle(is_inverse, (k * index * stride) % sequence_size);
                 }
+
+                first[index] = store(sum);
             }
         }
     }
@@ -300,13 +328,14 @@ private:
         bool const is_inverse,
         difference_type const& remainder,
         difference_type const& stride,
-        typename std::vector<value_type>::iterator first) const
+        iterator first) const
     {
         for (auto i = difference_type{0}; i < remainder; ++i)
         {
-            auto const t = first[remainder + i] * conjugate(is_inverse, twiddles.at(i * stride));
-            first[remainder + i] = first[i] - t;
-            first[i] += t;
+            auto const t0 = load(first[i]);
+            auto const t1 = load(first[remainder + i]) * twiddle(is_inverse, i * stride);
+            first[remainder + i] = store(t0 - t1);
+            first[i] = store(t0 + t1);
         }
     }
 
@@ -314,26 +343,26 @@ private:
         bool const is_inverse,
         difference_type const& remainder,
         difference_type const& stride,
-        typename std::vector<value_type>::iterator first) const
+        iterator first) const
     {
         using std::real;
         using std::imag;
 
-        auto const t0 = imag(conjugate(is_inverse, twiddles.at(remainder * stride)));
+        auto const t0 = imag(twiddle(is_inverse, remainder * stride));
 
         for (auto i = difference_type{0}; i < remainder; ++i)
         {
-            auto const t1 = first[remainder + i] * conjugate(is_inverse, twiddles.at(i * stride));
-            auto const t2
-                = first[2 * remainder + i] * conjugate(is_inverse, twiddles.at(2 * i * stride));
+            auto const t1 = load(first[remainder + i]) * twiddle(is_inverse, i * stride);
+            auto const t2 = load(first[2 * remainder + i]) * twiddle(is_inverse, 2 * i * stride);
             auto const t3 = t1 + t2;
             auto const t4 = (t1 - t2) * t0;
-            first[remainder + i] = value_type(
-                real(first[i]) - 0.5 * real(t3), imag(first[i]) - 0.5 * imag(t3));
-            first[i] += t3;
-            first[2 * remainder + i] = value_type(
-                real(first[remainder + i]) + imag(t4), imag(first[remainder + i]) - real(t4));
-            first[remainder + i] += value_type(-imag(t4), real(t4));
+            auto const t5 = load(first[i]);
+            auto const t6 = value_type(
+                real(t5) - element_type(0.5) * real(t3),
+                imag(t5) - element_type(0.5) * imag(t3));
+            first[i] = store(t5 + t3);
+            first[2 * remainder + i] = store(value_type(real(t6) + imag(t4), imag(t6) - real(t4)));
+            first[remainder + i] = store(t6 + value_type(-imag(t4), real(t4)));
         }
     }
 
@@ -341,28 +370,26 @@ private:
         bool const is_inverse,
         difference_type const& remainder,
         difference_type const& stride,
-        typename std::vector<value_type>::iterator first) const
+        iterator first) const
     {
         using std::real;
         using std::imag;
 
         for (auto i = difference_type{0}; i < remainder; ++i)
         {
-            auto const t0
-                = first[remainder + i] * conjugate(is_inverse, twiddles.at(i * stride));
-            auto const t1
-                = first[2 * remainder + i] * conjugate(is_inverse, twiddles.at(2 * i * stride));
-            auto const t2
-                = first[3 * remainder + i] * conjugate(is_inverse, twiddles.at(3 * i * stride));
-            auto const t3 = first[i] - t1;
-            first[i] += t1;
+            auto const t0 = load(first[remainder + i]) * twiddle(is_inverse, i * stride);
+            auto const t1 = load(first[2 * remainder + i]) * twiddle(is_inverse, 2 * i * stride);
+            auto const t2 = load(first[3 * remainder + i]) * twiddle(is_inverse, 3 * i * stride);
+            auto const t6 = load(first[i]);
+            auto const t3 = t6 - t1;
+            auto const t7 = t6 + t1;
             auto const t4 = t0 + t2;
             auto t5 = t0 - t2;
-            t5 = (is_inverse ? -1. : 1.) * value_type(imag(t5), -real(t5));
-            first[2 * remainder + i] = first[i] - t4;
-            first[i] += t4;
-            first[remainder + i] = t3 + t5;
-            first[3 * remainder + i] = t3 - t5;
+            t5 = element_type(is_inverse ? -1. : 1.) * value_type(imag(t5), -real(t5));
+            first[2 * remainder + i] = store(t7 - t4);
+            first[i] = store(t7 + t4);
+            first[remainder + i] = store(t3 + t5);
+            first[3 * remainder + i] = store(t3 - t5);
         }
     }
 
@@ -370,46 +397,42 @@ private:
         bool const is_inverse,
         difference_type const& remainder,
         difference_type const& stride,
-        typename std::vector<value_type>::iterator first) const
+        iterator first) const
     {
         using std::real;
         using std::imag;
 
-        auto const t0 = conjugate(is_inverse, twiddles.at(remainder * stride));
-        auto const t1 = conjugate(is_inverse, twiddles.at(2u * remainder * stride));
+        auto const t0 = twiddle(is_inverse, remainder * stride);
+        auto const t1 = twiddle(is_inverse, 2 * remainder * stride);
 
         for (auto i = difference_type{0}; i < remainder; ++i)
         {
-            auto const t2 = first[i];
-            auto const t3
-                = first[remainder + i] * conjugate(is_inverse, twiddles.at(i * stride));
-            auto const t4
-                = first[2 * remainder + i] * conjugate(is_inverse, twiddles.at(2 * i * stride));
-            auto const t5
-                = first[3 * remainder + i] * conjugate(is_inverse, twiddles.at(3 * i * stride));
-            auto const t6
-                = first[4 * remainder + i] * conjugate(is_inverse, twiddles.at(4 * i * stride));
+            auto const t2 = load(first[i]);
+            auto const t3 = load(first[remainder + i]) * twiddle(is_inverse, i * stride);
+            auto const t4 = load(first[2 * remainder + i]) * twiddle(is_inverse, 2 * i * stride);
+            auto const t5 = load(first[3 * remainder + i]) * twiddle(is_inverse, 3 * i * stride);
+            auto const t6 = load(first[4 * remainder + i]) * twiddle(is_inverse, 4 * i * stride);
             auto const t7 = t3 + t6;
             auto const t8 = t3 - t6;
             auto const t9 = t4 + t5;
             auto const t10 = t4 - t5;
-            first[i] = first[i] + t7 + t9;
+            first[i] = store(t2 + t7 + t9);
             auto const t11 = t2 + value_type(
                 real(t7) * real(t0) + real(t9) * real(t1),
                 imag(t7) * real(t0) + imag(t9) * real(t1));
             auto const t12 = value_type(
                 imag(t8) * imag(t0) + imag(t10) * imag(t1),
                 -real(t8) * imag(t0) - real(t10) * imag(t1));
-            first[remainder + i] = t11 - t12;
-            first[4 * remainder + i] = t11 + t12;
+            first[remainder + i] = store(t11 - t12);
+            first[4 * remainder + i] = store(t11 + t12);
             auto const t13 = t2 + value_type(
                 real(t7) * real(t1) + real(t9) * real(t0),
                 imag(t7) * real(t1) + imag(t9) * real(t0));
             auto const t14 = value_type(
                 -imag(t8) * imag(t1) + imag(t10) * imag(t0),
                 real(t8) * imag(t1) - real(t10) * imag(t0));
-            first[2 * remainder + i] = t13 + t14;
-            first[3 * remainder + i] = t13 - t14;
+            first[2 * remainder + i] = store(t13 + t14);
+            first[3 * remainder + i] = store(t13 - t14);
         }
     }
 };
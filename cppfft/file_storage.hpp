@@ -0,0 +1,103 @@
+#ifndef CPPFFT_FILE_STORAGE_HPP
+#define CPPFFT_FILE_STORAGE_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace cppfft {
+
+template <typename ValueType, typename DifferenceType = std::ptrdiff_t>
+class file_storage
+{
+public:
+    using value_type = ValueType;
+    using difference_type = DifferenceType;
+
+    static_assert(std::is_trivially_copyable<value_type>::value,
+        "file_storage: value_type must be trivially copyable");
+
+private:
+    std::fstream file;
+    difference_type sequence_size;
+
+public:
+    file_storage() = delete;
+    file_storage(file_storage const&) = delete;
+    file_storage(file_storage&&) = default;
+
+    explicit file_storage(std::string const& path)
+        : file(path, std::ios::in | std::ios::out | std::ios::binary)
+    {
+        if (!file)
+        {
+            throw std::runtime_error("file_storage::file_storage: cannot open " + path + "\n");
+        }
+
+        file.seekg(0, std::ios::end);
+        sequence_size = static_cast<difference_type>(
+            static_cast<std::streamoff>(file.tellg()) / std::streamoff(sizeof(value_type)));
+    }
+
+    ~file_storage() = default;
+
+    auto operator=(file_storage const&) & -> file_storage& = delete;
+    auto operator=(file_storage&&) & -> file_storage& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return sequence_size;
+    }
+
+    auto read(difference_type position, difference_type count, value_type* result)
+        -> value_type*
+    {
+        if (position < 0 || count < 0 || position + count > sequence_size)
+        {
+            throw std::out_of_range("file_storage::read: block is out of range\n");
+        }
+
+        file.seekg(std::streamoff(position) * std::streamoff(sizeof(value_type)));
+        file.read(reinterpret_cast<char*>(result),
+            std::streamsize(count) * std::streamsize(sizeof(value_type)));
+
+        if (!file)
+        {
+            throw std::runtime_error("file_storage::read: read failed\n");
+        }
+
+        return result + count;
+    }
+
+    auto write(difference_type position, difference_type count, value_type const* first)
+        -> value_type const*
+    {
+        if (position < 0 || count < 0 || position + count > sequence_size)
+        {
+            throw std::out_of_range("file_storage::write: block is out of range\n");
+        }
+
+        file.seekp(std::streamoff(position) * std::streamoff(sizeof(value_type)));
+        file.write(reinterpret_cast<char const*>(first),
+            std::streamsize(count) * std::streamsize(sizeof(value_type)));
+
+        if (!file)
+        {
+            throw std::runtime_error("file_storage::write: write failed\n");
+        }
+
+        return first + count;
+    }
+
+    auto flush() -> void
+    {
+        file.flush();
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_FILE_STORAGE_HPP
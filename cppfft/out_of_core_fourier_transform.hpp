@@ -0,0 +1,244 @@
+#ifndef CPPFFT_OUT_OF_CORE_FOURIER_TRANSFORM_HPP
+#define CPPFFT_OUT_OF_CORE_FOURIER_TRANSFORM_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "./detail/unit_phasor.hpp"
+#include "./fast_fourier_transform.hpp"
+#include "./transpose.hpp"
+
+namespace cppfft {
+
+template <typename ComplexType, typename DifferenceType = std::ptrdiff_t>
+class out_of_core_fourier_transform
+{
+public:
+    using value_type = ComplexType;
+    using element_type = typename value_type::value_type;
+    using difference_type = DifferenceType;
+
+private:
+    difference_type sequence_size;
+    difference_type rows;
+    difference_type columns;
+    difference_type panel_size;
+    cppfft::fast_fourier_transform<value_type, difference_type> column_transform;
+    cppfft::fast_fourier_transform<value_type, difference_type> row_transform;
+    std::vector<value_type> coarse_twiddles;
+    std::vector<value_type> fine_twiddles;
+
+public:
+    out_of_core_fourier_transform() = delete;
+    out_of_core_fourier_transform(out_of_core_fourier_transform const&) = default;
+    out_of_core_fourier_transform(out_of_core_fourier_transform&&) = default;
+
+    out_of_core_fourier_transform(difference_type n, difference_type memory)
+        : sequence_size(n),
+          rows(factor(n)),
+          columns(rows == 0 ? 0 : n / rows),
+          panel_size(memory / 2),
+          column_transform(rows),
+          row_transform(columns)
+    {
+        auto const block = std::max(
+            difference_type{1}, difference_type(4096 / sizeof(value_type)));
+
+        if (memory < 2 * std::max(
+            rows * std::min(columns, block), columns * std::min(rows, block)))
+        {
+            throw std::length_error(rows < std::min(columns, block)
+                ? "out_of_core_fourier_transform::out_of_core_fourier_transform: "
+                    "size has no divisor near its square root, "
+                    "so a panel spans the whole sequence\n"
+                : "out_of_core_fourier_transform::out_of_core_fourier_transform: "
+                    "memory must hold two panels a page wide\n");
+        }
+
+        coarse_twiddles.resize(columns);
+        fine_twiddles.resize(rows);
+
+        for (auto i = difference_type{0}; i < columns; ++i)
+        {
+            coarse_twiddles.at(i) = cppfft::detail::unit_phasor<value_type>(-2 * i, columns);
+        }
+
+        for (auto i = difference_type{0}; i < rows; ++i)
+        {
+            fine_twiddles.at(i) = cppfft::detail::unit_phasor<value_type>(-2 * i, sequence_size);
+        }
+    }
+
+    ~out_of_core_fourier_transform() = default;
+
+    auto operator=(out_of_core_fourier_transform const&) & -> out_of_core_fourier_transform&
+        = default;
+    auto operator=(out_of_core_fourier_transform&&) & -> out_of_core_fourier_transform&
+        = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return sequence_size;
+    }
+
+    template <typename TransformType, typename InputStorage, typename OutputStorage>
+    auto operator()(TransformType&&, InputStorage& input, OutputStorage& output) const
+        -> std::enable_if_t<
+            std::is_same<std::decay_t<TransformType>, cppfft::forward_t>::value
+                || std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value,
+            OutputStorage&>
+    {
+        auto const is_inverse
+            = std::is_same<std::decay_t<TransformType>, cppfft::inverse_t>::value;
+
+        if (static_cast<void const*>(&input) == static_cast<void const*>(&output))
+        {
+            throw std::invalid_argument(
+                "out_of_core_fourier_transform::operator(): input and output must differ\n");
+        }
+
+        if (input.size() < sequence_size || output.size() < sequence_size)
+        {
+            throw std::length_error(
+                "out_of_core_fourier_transform::operator(): storage is too small\n");
+        }
+
+        auto panel = std::vector<value_type>();
+        auto buffer = std::vector<value_type>();
+
+        auto const width = std::min(columns, panel_size / std::max(rows, difference_type{1}));
+
+        for (auto first = difference_type{0}; first < columns; first += width)
+        {
+            auto const count = std::min(width, columns - first);
+            panel.resize(rows * count);
+            buffer.resize(rows * count);
+
+            for (auto i = difference_type{0}; i < rows; ++i)
+            {
+                input.read(i * columns + first, count, panel.data() + i * count);
+            }
+
+            cppfft::transpose(panel.data(), rows, count, buffer.data());
+
+            for (auto j = difference_type{0}; j < count; ++j)
+            {
+                auto const column = buffer.begin() + j * rows;
+                transform(is_inverse, column_transform, column);
+
+                for (auto k = difference_type{1}; k < rows; ++k)
+                {
+                    column[k] *= twiddle(is_inverse, (first + j) * k);
+                }
+            }
+
+            output.write(first * rows, count * rows, buffer.data());
+        }
+
+        auto const height = std::min(rows, panel_size / std::max(columns, difference_type{1}));
+
+        for (auto first = difference_type{0}; first < rows; first += height)
+        {
+            auto const count = std::min(height, rows - first);
+            panel.resize(columns * count);
+            buffer.resize(columns * count);
+
+            for (auto i = difference_type{0}; i < columns; ++i)
+            {
+                output.read(i * rows + first, count, panel.data() + i * count);
+            }
+
+            cppfft::transpose(panel.data(), columns, count, buffer.data());
+
+            for (auto j = difference_type{0}; j < count; ++j)
+            {
+                transform(is_inverse, row_transform, buffer.begin() + j * columns);
+            }
+
+            cppfft::transpose(buffer.data(), count, columns, panel.data());
+
+            for (auto i = difference_type{0}; i < columns; ++i)
+            {
+                output.write(i * rows + first, count, panel.data() + i * count);
+            }
+        }
+
+        return output;
+    }
+
+    template <typename InputStorage, typename OutputStorage>
+    auto operator()(InputStorage& input, OutputStorage& output) const -> OutputStorage&
+    {
+        return (*this)(cppfft::forward, input, output);
+    }
+
+    template <typename InputStorage, typename OutputStorage>
+    auto forward(InputStorage& input, OutputStorage& output) const -> OutputStorage&
+    {
+        return (*this)(cppfft::forward, input, output);
+    }
+
+    template <typename InputStorage, typename OutputStorage>
+    auto inverse(InputStorage& input, OutputStorage& output) const -> OutputStorage&
+    {
+        return (*this)(cppfft::inverse, input, output);
+    }
+
+private:
+    static auto factor(difference_type n) -> difference_type
+    {
+        if (n < 0)
+        {
+            throw std::length_error(
+                "out_of_core_fourier_transform::out_of_core_fourier_transform: "
+                "size must be non-negative\n");
+        }
+
+        using std::sqrt;
+        auto root = static_cast<difference_type>(sqrt(static_cast<double>(n)));
+
+        while (root * root > n)
+        {
+            --root;
+        }
+
+        while ((root + 1) * (root + 1) <= n)
+        {
+            ++root;
+        }
+
+        for (auto i = root; i > 1; --i)
+        {
+            if (n % i == 0)
+            {
+                return i;
+            }
+        }
+
+        return n == 0 ? 0 : 1;
+    }
+
+    auto twiddle(bool const is_inverse, difference_type const& index) const -> value_type
+    {
+        using std::conj;
+        auto const t = coarse_twiddles[index / rows] * fine_twiddles[index % rows];
+        return is_inverse ? conj(t) : t;
+    }
+
+    template <typename Iterator>
+    static auto transform(
+        bool const is_inverse,
+        cppfft::fast_fourier_transform<value_type, difference_type> const& plan,
+        Iterator first)
+    {
+        is_inverse ? plan.inverse(first, first) : plan.forward(first, first);
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_OUT_OF_CORE_FOURIER_TRANSFORM_HPP
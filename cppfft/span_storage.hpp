@@ -0,0 +1,71 @@
+#ifndef CPPFFT_SPAN_STORAGE_HPP
+#define CPPFFT_SPAN_STORAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace cppfft {
+
+template <typename ValueType, typename DifferenceType = std::ptrdiff_t>
+class span_storage
+{
+public:
+    using value_type = ValueType;
+    using difference_type = DifferenceType;
+
+private:
+    value_type* data;
+    difference_type sequence_size;
+
+public:
+    span_storage() = delete;
+    span_storage(span_storage const&) = default;
+    span_storage(span_storage&&) = default;
+
+    span_storage(value_type* first, difference_type n)
+        : data(first), sequence_size(n)
+    {
+        if (n < 0)
+        {
+            throw std::length_error("span_storage::span_storage: size must be non-negative\n");
+        }
+    }
+
+    ~span_storage() = default;
+
+    auto operator=(span_storage const&) & -> span_storage& = default;
+    auto operator=(span_storage&&) & -> span_storage& = default;
+
+    auto size() const noexcept -> difference_type const&
+    {
+        return sequence_size;
+    }
+
+    auto read(difference_type position, difference_type count, value_type* result) const
+        -> value_type*
+    {
+        if (position < 0 || count < 0 || position + count > sequence_size)
+        {
+            throw std::out_of_range("span_storage::read: block is out of range\n");
+        }
+
+        return std::copy_n(data + position, count, result);
+    }
+
+    auto write(difference_type position, difference_type count, value_type const* first)
+        -> value_type const*
+    {
+        if (position < 0 || count < 0 || position + count > sequence_size)
+        {
+            throw std::out_of_range("span_storage::write: block is out of range\n");
+        }
+
+        std::copy_n(first, count, data + position);
+        return first + count;
+    }
+};
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_SPAN_STORAGE_HPP
@@ -0,0 +1,329 @@
+#ifndef CPPFFT_TRANSPOSE_HPP
+#define CPPFFT_TRANSPOSE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "./detail/is_random_accessible_iterator.hpp"
+
+namespace cppfft {
+
+namespace detail {
+
+template <typename RandomAccessIterator>
+constexpr auto transpose_tile_size()
+{
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    return std::max(std::ptrdiff_t{64}, std::ptrdiff_t{4096} / std::ptrdiff_t(sizeof(value_type)));
+}
+
+template <typename RandomAccessIterator1, typename DifferenceType, typename RandomAccessIterator2>
+auto transpose_block(
+    RandomAccessIterator1 first,
+    DifferenceType rows,
+    DifferenceType columns,
+    RandomAccessIterator2 result,
+    DifferenceType row_first,
+    DifferenceType row_last,
+    DifferenceType column_first,
+    DifferenceType column_last)
+    -> void
+{
+    auto const height = row_last - row_first;
+    auto const width = column_last - column_first;
+
+    if (height * width <= cppfft::detail::transpose_tile_size<RandomAccessIterator1>())
+    {
+        for (auto i = row_first; i < row_last; ++i)
+        {
+            for (auto j = column_first; j < column_last; ++j)
+            {
+                result[j * rows + i] = first[i * columns + j];
+            }
+        }
+
+        return;
+    }
+
+    if (height >= width)
+    {
+        auto const middle = row_first + height / 2;
+        cppfft::detail::transpose_block(
+            first, rows, columns, result, row_first, middle, column_first, column_last);
+        cppfft::detail::transpose_block(
+            first, rows, columns, result, middle, row_last, column_first, column_last);
+    }
+    else
+    {
+        auto const middle = column_first + width / 2;
+        cppfft::detail::transpose_block(
+            first, rows, columns, result, row_first, row_last, column_first, middle);
+        cppfft::detail::transpose_block(
+            first, rows, columns, result, row_first, row_last, middle, column_last);
+    }
+}
+
+template <typename RandomAccessIterator, typename DifferenceType>
+auto swap_block(
+    RandomAccessIterator first,
+    DifferenceType size,
+    DifferenceType row_first,
+    DifferenceType row_last,
+    DifferenceType column_first,
+    DifferenceType column_last)
+    -> void
+{
+    auto const height = row_last - row_first;
+    auto const width = column_last - column_first;
+
+    if (height * width <= cppfft::detail::transpose_tile_size<RandomAccessIterator>())
+    {
+        using std::swap;
+
+        for (auto i = row_first; i < row_last; ++i)
+        {
+            for (auto j = column_first; j < column_last; ++j)
+            {
+                swap(first[i * size + j], first[j * size + i]);
+            }
+        }
+
+        return;
+    }
+
+    if (height >= width)
+    {
+        auto const middle = row_first + height / 2;
+        cppfft::detail::swap_block(first, size, row_first, middle, column_first, column_last);
+        cppfft::detail::swap_block(first, size, middle, row_last, column_first, column_last);
+    }
+    else
+    {
+        auto const middle = column_first + width / 2;
+        cppfft::detail::swap_block(first, size, row_first, row_last, column_first, middle);
+        cppfft::detail::swap_block(first, size, row_first, row_last, middle, column_last);
+    }
+}
+
+template <typename RandomAccessIterator, typename DifferenceType>
+auto transpose_diagonal(
+    RandomAccessIterator first,
+    DifferenceType size,
+    DifferenceType lower,
+    DifferenceType upper)
+    -> void
+{
+    auto const length = upper - lower;
+
+    if (length * length <= cppfft::detail::transpose_tile_size<RandomAccessIterator>())
+    {
+        using std::swap;
+
+        for (auto i = lower; i < upper; ++i)
+        {
+            for (auto j = i + 1; j < upper; ++j)
+            {
+                swap(first[i * size + j], first[j * size + i]);
+            }
+        }
+
+        return;
+    }
+
+    auto const middle = lower + length / 2;
+    cppfft::detail::transpose_diagonal(first, size, lower, middle);
+    cppfft::detail::transpose_diagonal(first, size, middle, upper);
+    cppfft::detail::swap_block(first, size, lower, middle, middle, upper);
+}
+
+template <typename RandomAccessIterator>
+auto transpose_cycles(
+    RandomAccessIterator first,
+    std::uintmax_t rows,
+    std::uintmax_t columns,
+    std::uintmax_t length)
+    -> void
+{
+    if (rows < 2u || columns < 2u)
+    {
+        return;
+    }
+
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+    auto const size = rows * columns;
+    auto const block = [&](std::uintmax_t position)
+    {
+        return first + static_cast<difference_type>(position * length);
+    };
+
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    auto buffer = std::vector<value_type>();
+    buffer.reserve(length);
+    auto visited = std::vector<bool>(size);
+
+    for (auto i = std::uintmax_t{1}; i < size - 1u; ++i)
+    {
+        if (visited[i])
+        {
+            continue;
+        }
+
+        buffer.assign(std::make_move_iterator(block(i)), std::make_move_iterator(block(i + 1u)));
+        auto position = i;
+
+        for (auto source = i * columns % (size - 1u); source != i;
+            source = source * columns % (size - 1u))
+        {
+            std::move(block(source), block(source + 1u), block(position));
+            visited[position] = true;
+            position = source;
+        }
+
+        std::move(buffer.begin(), buffer.end(), block(position));
+        visited[position] = true;
+    }
+}
+
+} // namespace detail
+
+template <typename RandomAccessIterator1, typename DifferenceType, typename RandomAccessIterator2>
+auto transpose(
+    RandomAccessIterator1 first,
+    DifferenceType rows,
+    DifferenceType columns,
+    RandomAccessIterator2 result,
+    std::size_t concurrency)
+    -> std::enable_if_t<
+        cppfft::detail::is_random_accessible_iterator_v<RandomAccessIterator1>
+            && cppfft::detail::is_random_accessible_iterator_v<RandomAccessIterator2>,
+        RandomAccessIterator2>
+{
+    auto const along_rows = rows >= columns;
+    auto const length = along_rows ? rows : columns;
+    auto const work = static_cast<DifferenceType>(
+        64 * cppfft::detail::transpose_tile_size<RandomAccessIterator1>());
+    auto const bands = std::max(DifferenceType{1}, std::min({
+        length, static_cast<DifferenceType>(concurrency), rows * columns / work}));
+
+    auto workers = std::vector<std::thread>();
+    workers.reserve(bands - 1);
+
+    auto const join = [&]
+    {
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    };
+
+    try
+    {
+        for (auto i = DifferenceType{0}; i < bands; ++i)
+        {
+            auto const lower = length * i / bands;
+            auto const upper = length * (i + 1) / bands;
+            auto const band = [=]
+            {
+                along_rows
+                    ? cppfft::detail::transpose_block(
+                        first, rows, columns, result, lower, upper, DifferenceType{0}, columns)
+                    : cppfft::detail::transpose_block(
+                        first, rows, columns, result, DifferenceType{0}, rows, lower, upper);
+            };
+
+            if (i + 1 == bands)
+            {
+                band();
+            }
+            else
+            {
+                workers.emplace_back(band);
+            }
+        }
+    }
+    catch (...)
+    {
+        join();
+        throw;
+    }
+
+    join();
+
+    return result + rows * columns;
+}
+
+template <typename RandomAccessIterator1, typename DifferenceType, typename RandomAccessIterator2>
+inline auto transpose(
+    RandomAccessIterator1 first,
+    DifferenceType rows,
+    DifferenceType columns,
+    RandomAccessIterator2 result)
+    -> std::enable_if_t<
+        cppfft::detail::is_random_accessible_iterator_v<RandomAccessIterator1>
+            && cppfft::detail::is_random_accessible_iterator_v<RandomAccessIterator2>,
+        RandomAccessIterator2>
+{
+    cppfft::detail::transpose_block(
+        first, rows, columns, result, DifferenceType{0}, rows, DifferenceType{0}, columns);
+    return result + rows * columns;
+}
+
+template <typename RandomAccessIterator, typename DifferenceType>
+auto transpose_in_place(RandomAccessIterator first, DifferenceType rows, DifferenceType columns)
+    -> std::enable_if_t<cppfft::detail::is_random_accessible_iterator_v<RandomAccessIterator>>
+{
+    if (rows == columns)
+    {
+        cppfft::detail::transpose_diagonal(first, rows, DifferenceType{0}, rows);
+        return;
+    }
+
+    using difference_type = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+    auto divisor = static_cast<std::uintmax_t>(rows);
+
+    for (auto remainder = static_cast<std::uintmax_t>(columns); remainder != 0u; )
+    {
+        divisor = std::exchange(remainder, divisor % remainder);
+    }
+
+    if (divisor == 0u)
+    {
+        return;
+    }
+
+    auto const tile = divisor * divisor;
+    auto const height = static_cast<std::uintmax_t>(rows) / divisor;
+    auto const width = static_cast<std::uintmax_t>(columns) / divisor;
+    auto const offset = [&](std::uintmax_t position)
+    {
+        return first + static_cast<difference_type>(position);
+    };
+
+    for (auto i = std::uintmax_t{0}; i < height; ++i)
+    {
+        cppfft::detail::transpose_cycles(offset(i * tile * width), divisor, width, divisor);
+
+        for (auto j = i * width; j < (i + 1u) * width; ++j)
+        {
+            cppfft::detail::transpose_diagonal(offset(j * tile),
+                difference_type(divisor), difference_type{0}, difference_type(divisor));
+        }
+    }
+
+    cppfft::detail::transpose_cycles(first, height, width, tile);
+
+    for (auto i = std::uintmax_t{0}; i < width; ++i)
+    {
+        cppfft::detail::transpose_cycles(offset(i * tile * height), height, divisor, divisor);
+    }
+}
+
+} // namespace cppfft
+
+#endif // #ifndef CPPFFT_TRANSPOSE_HPP
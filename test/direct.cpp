@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "../cppfft/discrete_cosine_transform.hpp"
+#include "../cppfft/discrete_cosine_transform_iv.hpp"
+#include "../cppfft/discrete_sine_transform.hpp"
+#include "../cppfft/discrete_sine_transform_iv.hpp"
+#include "../cppfft/fast_fourier_transform.hpp"
+
+namespace {
+
+using value_type = std::complex<double>;
+
+auto const pi = std::acos(-1.);
+auto const tolerance = 1e-9;
+auto failures = 0;
+
+auto report(char const* name, std::ptrdiff_t n, double error, double round_trip) -> void
+{
+    if (!(error <= tolerance) || !(round_trip <= tolerance))
+    {
+        ++failures;
+        std::cout << name << ' ' << n << ": error " << error
+            << ", round trip " << round_trip << '\n';
+    }
+}
+
+auto check_fourier(std::ptrdiff_t n) -> void
+{
+    auto x = std::vector<value_type>(n);
+
+    for (auto i = std::ptrdiff_t{0}; i < n; ++i)
+    {
+        x[i] = value_type(std::sin(1.7 * double(i) + .3), std::cos(.9 * double(i * i)));
+    }
+
+    auto const plan = cppfft::fast_fourier_transform<value_type>(n);
+    auto y = std::vector<value_type>(n);
+    auto z = std::vector<value_type>(n);
+    plan.forward(x.cbegin(), y.begin());
+    plan.inverse(y.cbegin(), z.begin());
+
+    auto error = 0.;
+    auto round_trip = 0.;
+
+    for (auto k = std::ptrdiff_t{0}; k < n; ++k)
+    {
+        auto sum = value_type(0.);
+
+        for (auto i = std::ptrdiff_t{0}; i < n; ++i)
+        {
+            sum += x[i] * std::polar(1., -2. * pi * double(i * k % n) / double(n));
+        }
+
+        error = std::max(error, std::abs(sum - y[k]) / double(n));
+        round_trip = std::max(round_trip, std::abs(z[k] - x[k]));
+    }
+
+    report("fast_fourier_transform", n, error, round_trip);
+}
+
+template <typename Transform, typename Kernel>
+auto check_real(char const* name, std::ptrdiff_t n, Kernel kernel) -> void
+{
+    auto x = std::vector<double>(n);
+
+    for (auto i = std::ptrdiff_t{0}; i < n; ++i)
+    {
+        x[i] = std::sin(1.7 * double(i) + .3) + .1 * double(i % 7);
+    }
+
+    auto const plan = Transform(n);
+    auto y = std::vector<double>(n);
+    auto z = std::vector<double>(n);
+    plan.forward(x.cbegin(), y.begin());
+    plan.inverse(y.cbegin(), z.begin());
+
+    auto error = 0.;
+    auto round_trip = 0.;
+
+    for (auto k = std::ptrdiff_t{0}; k < n; ++k)
+    {
+        auto sum = 0.;
+
+        for (auto i = std::ptrdiff_t{0}; i < n; ++i)
+        {
+            sum += x[i] * kernel(double(i), double(k), double(n));
+        }
+
+        error = std::max(error, std::abs(sum - y[k]) / double(n));
+        round_trip = std::max(round_trip, std::abs(z[k] - x[k]));
+    }
+
+    report(name, n, error, round_trip);
+}
+
+} // namespace
+
+int main()
+{
+    for (auto n = std::ptrdiff_t{0}; n <= 160; ++n)
+    {
+        check_fourier(n);
+
+        check_real<cppfft::discrete_cosine_transform<value_type>>(
+            "discrete_cosine_transform", n,
+            [](double i, double k, double n) { return std::cos(pi / n * (i + .5) * k); });
+        check_real<cppfft::discrete_sine_transform<value_type>>(
+            "discrete_sine_transform", n,
+            [](double i, double k, double n) { return std::sin(pi / n * (i + .5) * (k + 1.)); });
+
+        if (n % 2 == 0)
+        {
+            check_real<cppfft::discrete_cosine_transform_iv<value_type>>(
+                "discrete_cosine_transform_iv", n,
+                [](double i, double k, double n) { return std::cos(pi / n * (i + .5) * (k + .5)); });
+            check_real<cppfft::discrete_sine_transform_iv<value_type>>(
+                "discrete_sine_transform_iv", n,
+                [](double i, double k, double n) { return std::sin(pi / n * (i + .5) * (k + .5)); });
+        }
+    }
+
+    std::cout << (failures == 0 ? "all sizes match the direct formulas\n" : "FAILED\n");
+    return failures == 0 ? 0 : 1;
+}